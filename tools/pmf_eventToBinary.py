@@ -0,0 +1,69 @@
+#!/usr/bin/python
+
+import argparse
+import struct
+
+# parse argument
+parser = argparse.ArgumentParser(description='convert an ASCII event file (source, patch or infiltration) to the binary event format')
+# positional arguments
+parser.add_argument("input", help='specify input event file .evt')
+parser.add_argument("output", help='specify output binary event file')
+# optional arguments
+parser.add_argument("-k", "--kind", help='kind of event file', choices=['source', 'patch', 'infiltration'], required=True)
+args = parser.parse_args()
+
+kinds = {'source': 0, 'patch': 1, 'infiltration': 2}
+
+# reading file
+dates = []
+columns = []
+datas = []
+kind = args.kind
+with open(args.input) as file_in:
+    for line in file_in:
+        split = line.split()
+        if len(split) == 0:
+            continue
+        if split[0] == 'date':
+            dates.append(float(split[1]))
+            datas.append([])
+            continue
+        if kind == 'source':
+            if len(dates) == 1:
+                columns.append([float(x) for x in split[0:3]])
+            datas[-1].append(float(split[3]))
+        elif kind == 'patch':
+            if len(dates) == 1:
+                columns.append(split[0])
+            datas[-1].append(float(split[1]))
+        else:
+            datas[-1] = [float(x) for x in split]
+
+ndates = len(dates)
+if kind == 'infiltration':
+    ncolumns = max(len(values) for values in datas)
+    # uniform values of a non-uniform file are expanded to the field size
+    datas = [values*ncolumns if len(values) == 1 else values for values in datas]
+else:
+    ncolumns = len(columns)
+if len(datas) != ndates or any(len(values) != ncolumns for values in datas):
+    raise SystemExit('wrong number of datas in '+args.input+' : expected '+str(ndates)+' dates x '+str(ncolumns)+' columns')
+
+# writing file
+file_out = open(args.output, 'wb')
+file_out.write(b'PMFEVTB1')
+# byte order marker and sizes (little-endian)
+file_out.write(struct.pack('<iiqq', 0x01020304, kinds[kind], ndates, ncolumns))
+if kind == 'source':
+    for coordinates in columns:
+        file_out.write(struct.pack('<3d', *coordinates))
+elif kind == 'patch':
+    for name in columns:
+        file_out.write(struct.pack('<i', len(name)))
+        file_out.write(name.encode())
+file_out.write(struct.pack('<%dd' % ndates, *dates))
+for values in datas:
+    file_out.write(struct.pack('<%dd' % ncolumns, *values))
+file_out.close()
+
+print(kind+' event file '+args.output+' written : '+str(ndates)+' dates x '+str(ncolumns)+' columns')
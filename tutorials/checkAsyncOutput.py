@@ -0,0 +1,106 @@
+# -*- coding: utf-8 -*-
+## \file checkAsyncOutput.py for python 3
+## Script for comparing the files written with asynchronous output
+## (asyncOutput yes in controlDict) with the synchronous ones
+
+# import
+from __future__ import with_statement
+import os, filecmp, shutil, subprocess, sys, argparse
+
+testCases = [{'solver' : "groundwaterFoam", 'case' : "1Dinfiltration"}, \
+             {'solver' : "groundwaterTransportFoam", 'case' : "1Dinfiltration_Ufixed"}]
+
+#=============================================================================
+# ROUTINE run : copy and run a case, returns True if ok
+#=============================================================================
+def run(solver, case, runDir, asyncOutput):
+
+    if os.path.exists(runDir):
+        shutil.rmtree(runDir)
+    shutil.copytree(solver+"-tutorials/"+case, runDir, symlinks=True)
+    if asyncOutput:
+        with open(os.path.join(runDir, "system", "controlDict"), 'a') as f:
+            f.write("\nasyncOutput yes;\n")
+
+    refDir = os.getcwd()
+    os.chdir(runDir)
+    ProcessPipe = subprocess.Popen("./run", shell=True, \
+                                   stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    ProcessPipe.communicate()
+    os.chdir(refDir)
+
+    logFile = os.path.join(runDir, "log."+solver)
+    if not os.path.exists(logFile):
+        return False
+    for line in open(logFile, 'r'):
+        if "FOAM exiting" in line or "FOAM aborting" in line:
+            return False
+    return True
+
+#=============================================================================
+# ROUTINE outputFiles : files written by the run (logs excepted)
+#=============================================================================
+def outputFiles(runDir, caseDir):
+
+    files = []
+    for root, dirs, names in os.walk(runDir):
+        for name in names:
+            path = os.path.relpath(os.path.join(root, name), runDir)
+            if name.startswith("log.") or name == "controlDict" \
+               or os.path.exists(os.path.join(caseDir, path)):
+                continue
+            files.append(path)
+    return sorted(files)
+
+#===============================================================================
+# PROGRAM Main
+#===============================================================================
+
+if __name__ == '__main__':
+
+    parser = argparse.ArgumentParser(description='compare asynchronous and synchronous outputs')
+    parser.add_argument("-w", "--workDir", help='directory where cases are run (default asyncOutput)', default="asyncOutput")
+    args = parser.parse_args()
+
+    print("========================================================")
+    print("            CHECKING ASYNCHRONOUS OUTPUT                ")
+    print("========================================================")
+
+    nErrors = 0
+    for case in testCases:
+        print("")
+        print("Test : " + case["solver"] + " " + case["case"])
+
+        caseDir = case["solver"]+"-tutorials/"+case["case"]
+        syncDir = os.path.join(args.workDir, "sync", case["solver"], case["case"])
+        asyncDir = os.path.join(args.workDir, "async", case["solver"], case["case"])
+        if not run(case["solver"], case["case"], syncDir, False) \
+           or not run(case["solver"], case["case"], asyncDir, True):
+            print("[ ERROR OpenFOAM ]")
+            nErrors += 1
+            continue
+
+        syncFiles = outputFiles(syncDir, caseDir)
+        asyncFiles = outputFiles(asyncDir, caseDir)
+        missing = sorted(set(syncFiles) ^ set(asyncFiles))
+        different = [path for path in syncFiles if path in asyncFiles and \
+                     not filecmp.cmp(os.path.join(syncDir, path), os.path.join(asyncDir, path), shallow=False)]
+
+        print("    compared files = " + str(len(syncFiles)))
+        for path in missing:
+            print("    only written by one run : " + path)
+        for path in different:
+            print("    different : " + path)
+
+        if len(syncFiles) == 0 or len(missing) > 0 or len(different) > 0:
+            print("[ FAILED ]")
+            nErrors += 1
+        else:
+            print("[ OK ]")
+
+    print(" ")
+    print("========================================================")
+    print("                        FINISHED                        ")
+    print("========================================================")
+
+    sys.exit(1 if nErrors > 0 else 0)
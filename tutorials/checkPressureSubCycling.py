@@ -0,0 +1,133 @@
+# -*- coding: utf-8 -*-
+## \file checkPressureSubCycling.py for python 3
+## Script for comparing the multirate IMPES (pressure sub-cycling) with the
+## usual IMPES scheme : mass conservation of phase b and final saturation
+
+# import
+from __future__ import with_statement
+import os, re, shutil, subprocess, sys, argparse
+
+testCases = [{'solver' : "impesFoam", 'case' : "Buckley-Leverett/BrooksAndCorey"}, \
+             {'solver' : "impesFoam", 'case' : "Buckley-Leverett/VanGenuchten"}, \
+             {'solver' : "impesFoam", 'case' : "injectionExtraction/injection"}, \
+             {'solver' : "impesFoam", 'case' : "injectionExtraction/extraction"}, \
+             {'solver' : "anisoImpesFoam", 'case' : "injectionAniso_case1"}, \
+             {'solver' : "anisoImpesFoam", 'case' : "injectionAniso_case2"}]
+
+#=============================================================================
+# ROUTINE run : copy and run a case, returns the log file name
+#=============================================================================
+def run(solver, case, runDir, threshold):
+
+    if os.path.exists(runDir):
+        shutil.rmtree(runDir)
+    shutil.copytree(solver+"-tutorials/"+case, runDir, symlinks=True)
+    with open(os.path.join(runDir, "system", "controlDict"), 'a') as f:
+        f.write("\nSbMassBalance yes;\n")
+        if threshold > 0:
+            f.write("pressureUpdateThreshold "+str(threshold)+";\n")
+
+    refDir = os.getcwd()
+    os.chdir(runDir)
+    ProcessPipe = subprocess.Popen("./run", shell=True, \
+                                   stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    ProcessPipe.communicate()
+    os.chdir(refDir)
+
+    return os.path.join(runDir, "log."+solver)
+
+#=============================================================================
+# ROUTINE readLog : last mass balance error and number of skipped solutions
+#=============================================================================
+def readLog(logFile):
+
+    if not os.path.exists(logFile):
+        return None
+    massError = None
+    skipped = 0
+    for line in open(logFile, 'r'):
+        if "FOAM exiting" in line or "FOAM aborting" in line:
+            return None
+        if line.startswith("Phase b mass balance"):
+            massError = float(line.split()[-1])
+        if line.startswith("Pressure solution skipped"):
+            skipped += 1
+    return {'massError' : massError, 'skipped' : skipped}
+
+#=============================================================================
+# ROUTINE readSb : internal field of Sb at the latest time
+#=============================================================================
+def readSb(runDir):
+
+    times = []
+    for name in os.listdir(runDir):
+        try:
+            if float(name) > 0 and os.path.exists(os.path.join(runDir, name, "Sb")):
+                times.append(name)
+        except ValueError:
+            continue
+    if len(times) == 0:
+        return None
+    latestTime = max(times, key=float)
+
+    content = open(os.path.join(runDir, latestTime, "Sb")).read()
+    uniform = re.search(r"internalField\s+uniform\s+([^;\s]+)\s*;", content)
+    if uniform:
+        return [float(uniform.group(1))]
+    nonuniform = re.search(r"internalField\s+nonuniform\s+List<scalar>\s*(\d+)\s*\(([^)]*)\)", content)
+    return [float(x) for x in nonuniform.group(2).split()]
+
+#===============================================================================
+# PROGRAM Main
+#===============================================================================
+
+if __name__ == '__main__':
+
+    parser = argparse.ArgumentParser(description='compare pressure sub-cycling of impesFoam/anisoImpesFoam with the usual IMPES scheme')
+    parser.add_argument("-t", "--threshold", help='pressureUpdateThreshold of the sub-cycled runs (default 0.01)', type=float, default=0.01)
+    parser.add_argument("-w", "--workDir", help='directory where cases are run (default subCycling)', default="subCycling")
+    parser.add_argument("-m", "--massTolerance", help='maximal relative mass balance error (default 1e-6)', type=float, default=1e-6)
+    parser.add_argument("-s", "--saturationTolerance", help='maximal saturation difference with the usual scheme, empirical acceptance level (default 0.02)', type=float, default=0.02)
+    args = parser.parse_args()
+
+    print("========================================================")
+    print("            CHECKING PRESSURE SUB-CYCLING               ")
+    print("========================================================")
+
+    nErrors = 0
+    for case in testCases:
+        print("")
+        print("Test : " + case["solver"] + " " + case["case"])
+
+        referenceDir = os.path.join(args.workDir, "reference", case["solver"], case["case"])
+        subCyclingDir = os.path.join(args.workDir, "subCycling", case["solver"], case["case"])
+        reference = readLog(run(case["solver"], case["case"], referenceDir, 0))
+        subCycling = readLog(run(case["solver"], case["case"], subCyclingDir, args.threshold))
+        if reference is None or subCycling is None \
+           or reference["massError"] is None or subCycling["massError"] is None:
+            print("[ ERROR OpenFOAM ]")
+            nErrors += 1
+            continue
+
+        SbReference = readSb(referenceDir)
+        SbSubCycling = readSb(subCyclingDir)
+        SbDifference = max(abs(a-b) for a, b in zip(SbReference, SbSubCycling))
+
+        print("    skipped pressure solutions = " + str(subCycling["skipped"]))
+        print("    mass balance error = " + "%g" % subCycling["massError"] \
+              + " (usual scheme " + "%g" % reference["massError"] + ")")
+        print("    max(|Sb - Sb_usual|) = " + "%g" % SbDifference)
+
+        if abs(subCycling["massError"]) > max(args.massTolerance, abs(reference["massError"])) \
+           or SbDifference > args.saturationTolerance:
+            print("[ FAILED ]")
+            nErrors += 1
+        else:
+            print("[ OK ]")
+
+    print(" ")
+    print("========================================================")
+    print("                        FINISHED                        ")
+    print("========================================================")
+
+    sys.exit(1 if nErrors > 0 else 0)
@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+## \file checkSharedTransportOperator.py for python 3
+## Script for comparing the transport operator shared by groups of species
+## in porousScalarTransportFoam with the operator assembled for each species
+## (sharedTransportOperator no in controlDict)
+
+# import
+from __future__ import with_statement
+import os, re, shutil, subprocess, sys, argparse
+
+testCases = [{'solver' : "porousScalarTransportFoam", 'case' : "1DeventFlux_multispecies", 'species' : ["C1", "C2"]}, \
+             {'solver' : "porousScalarTransportFoam", 'case' : "1DeventFlux_multispeciesMixedBC", 'species' : ["C1", "C2", "C3"]}]
+
+#=============================================================================
+# ROUTINE run : copy and run a case, returns True if ok
+#=============================================================================
+def run(solver, case, runDir, sharedOperator):
+
+    if os.path.exists(runDir):
+        shutil.rmtree(runDir)
+    shutil.copytree(solver+"-tutorials/"+case, runDir, symlinks=True)
+    if not sharedOperator:
+        with open(os.path.join(runDir, "system", "controlDict"), 'a') as f:
+            f.write("\nsharedTransportOperator no;\n")
+
+    refDir = os.getcwd()
+    os.chdir(runDir)
+    ProcessPipe = subprocess.Popen("./run", shell=True, \
+                                   stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    ProcessPipe.communicate()
+    os.chdir(refDir)
+
+    logFile = os.path.join(runDir, "log."+solver)
+    if not os.path.exists(logFile):
+        return False
+    for line in open(logFile, 'r'):
+        if "FOAM exiting" in line or "FOAM aborting" in line:
+            return False
+    return True
+
+#=============================================================================
+# ROUTINE readField : internal field of a scalar field at the latest time
+#=============================================================================
+def readField(runDir, fieldName):
+
+    times = []
+    for name in os.listdir(runDir):
+        try:
+            if float(name) > 0 and os.path.exists(os.path.join(runDir, name, fieldName)):
+                times.append(name)
+        except ValueError:
+            continue
+    if len(times) == 0:
+        return None
+    latestTime = max(times, key=float)
+
+    content = open(os.path.join(runDir, latestTime, fieldName)).read()
+    uniform = re.search(r"internalField\s+uniform\s+([^;\s]+)\s*;", content)
+    if uniform:
+        return [float(uniform.group(1))]
+    nonuniform = re.search(r"internalField\s+nonuniform\s+List<scalar>\s*(\d+)\s*\(([^)]*)\)", content)
+    return [float(x) for x in nonuniform.group(2).split()]
+
+#===============================================================================
+# PROGRAM Main
+#===============================================================================
+
+if __name__ == '__main__':
+
+    parser = argparse.ArgumentParser(description='compare the shared transport operator of porousScalarTransportFoam with the per species one')
+    parser.add_argument("-w", "--workDir", help='directory where cases are run (default sharedTransportOperator)', default="sharedTransportOperator")
+    parser.add_argument("-r", "--relativeTolerance", help='maximal difference relative to max(|C|) (default 1e-5, fields written with 6 digits)', type=float, default=1e-5)
+    args = parser.parse_args()
+
+    print("========================================================")
+    print("            CHECKING SHARED TRANSPORT OPERATOR          ")
+    print("========================================================")
+
+    nErrors = 0
+    for case in testCases:
+        print("")
+        print("Test : " + case["solver"] + " " + case["case"])
+
+        sharedDir = os.path.join(args.workDir, "shared", case["case"])
+        speciesDir = os.path.join(args.workDir, "species", case["case"])
+        if not run(case["solver"], case["case"], sharedDir, True) \
+           or not run(case["solver"], case["case"], speciesDir, False):
+            print("[ ERROR OpenFOAM ]")
+            nErrors += 1
+            continue
+
+        failed = False
+        for speciesName in case["species"]:
+            CShared = readField(sharedDir, speciesName)
+            CSpecies = readField(speciesDir, speciesName)
+            if CShared is None or CSpecies is None or len(CShared) != len(CSpecies):
+                print("    " + speciesName + " : missing field")
+                failed = True
+                continue
+            CMax = max(max(abs(x) for x in CSpecies), 1e-300)
+            difference = max(abs(a-b) for a, b in zip(CShared, CSpecies))/CMax
+            print("    " + speciesName + " : max(|C - C_species|)/max(|C_species|) = " + "%g" % difference)
+            if difference > args.relativeTolerance:
+                failed = True
+
+        if failed:
+            print("[ FAILED ]")
+            nErrors += 1
+        else:
+            print("[ OK ]")
+
+    print(" ")
+    print("========================================================")
+    print("                        FINISHED                        ")
+    print("========================================================")
+
+    sys.exit(1 if nErrors > 0 else 0)
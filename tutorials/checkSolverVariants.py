@@ -0,0 +1,155 @@
+# -*- coding: utf-8 -*-
+## \file checkSolverVariants.py for python 3
+## Script for comparing the variants of groundwaterFoam (system/fvSolution.<variant>
+## or constant/transportProperties.<variant> of 1Dinfiltration) with the default
+## settings and with the reference solution of the tutorial
+
+# import
+from __future__ import with_statement
+import os, glob, shutil, subprocess, sys, argparse
+
+testCase = {'solver' : "groundwaterFoam", 'case' : "1Dinfiltration"}
+
+variants = ["coloredJacobian", "Anderson", "checkKernels"]
+
+#- variants only checked for a successful run (no reference solution)
+runOnlyVariants = [{'solver' : "groundwaterFoam", 'case' : "realCase", 'variant' : "checkKernels"}]
+
+#=============================================================================
+# ROUTINE run : copy and run the case with one variant, returns True if ok
+#=============================================================================
+def run(solver, case, runDir, variant):
+
+    if os.path.exists(runDir):
+        shutil.rmtree(runDir)
+    shutil.copytree(solver+"-tutorials/"+case, runDir, symlinks=True)
+
+    refDir = os.getcwd()
+    os.chdir(runDir)
+    ProcessPipe = subprocess.Popen("./run "+variant, shell=True, \
+                                   stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    ProcessPipe.communicate()
+    os.chdir(refDir)
+
+    logFile = os.path.join(runDir, "log."+solver)
+    if not os.path.exists(logFile):
+        return False
+    for line in open(logFile, 'r'):
+        if "FOAM exiting" in line or "FOAM aborting" in line:
+            return False
+    return True
+
+#=============================================================================
+# ROUTINE readSample : (depth, h) of the sampled line at one time
+#=============================================================================
+def readSample(runDir, time):
+
+    files = glob.glob(os.path.join(runDir, "postProcessing", "sampleDict", time, "acrossFlow_h*"))
+    if len(files) == 0:
+        return None
+    sample = []
+    for line in open(files[0], 'r'):
+        values = line.split()
+        if len(values) < 2 or line.startswith("#"):
+            continue
+        sample.append((0.6-float(values[0]), float(values[1])))
+    return sorted(sample)
+
+#=============================================================================
+# ROUTINE referenceError : max difference between the sample and a reference
+#=============================================================================
+def referenceError(sample, referenceFile):
+
+    reference = sorted([(float(line.split()[0]), float(line.split()[1])) \
+                        for line in open(referenceFile, 'r') if len(line.split()) >= 2])
+    error = 0
+    for depth, h in sample:
+        if depth < reference[0][0] or depth > reference[-1][0]:
+            continue
+        for i in range(len(reference)-1):
+            if reference[i][0] <= depth <= reference[i+1][0]:
+                (d0, h0), (d1, h1) = reference[i], reference[i+1]
+                href = h0 if d1 == d0 else h0 + (h1-h0)*(depth-d0)/(d1-d0)
+                error = max(error, abs(h-href))
+                break
+    return error
+
+#===============================================================================
+# PROGRAM Main
+#===============================================================================
+
+if __name__ == '__main__':
+
+    parser = argparse.ArgumentParser(description='compare the variants of groundwaterFoam with the default settings')
+    parser.add_argument("-w", "--workDir", help='directory where cases are run (default solverVariants)', default="solverVariants")
+    parser.add_argument("-i", "--identicalTolerance", help='maximal difference of h with the default settings (default 1e-6)', type=float, default=1e-6)
+    args = parser.parse_args()
+
+    caseDir = testCase["solver"]+"-tutorials/"+testCase["case"]
+    times = {"17000" : "17ks.csv", "50000" : "50ks.csv", "95000" : "95ks.csv"}
+
+    print("========================================================")
+    print("            CHECKING SOLVER VARIANTS                    ")
+    print("========================================================")
+
+    defaultDir = os.path.join(args.workDir, "default")
+    if not run(testCase["solver"], testCase["case"], defaultDir, ""):
+        print("[ ERROR OpenFOAM ] default settings")
+        sys.exit(1)
+
+    nErrors = 0
+    for variant in variants:
+        print("")
+        print("Test : " + testCase["solver"] + " " + testCase["case"] + " " + variant)
+
+        variantDir = os.path.join(args.workDir, variant)
+        if not run(testCase["solver"], testCase["case"], variantDir, variant):
+            print("[ ERROR OpenFOAM ]")
+            nErrors += 1
+            continue
+
+        failed = False
+        for time in sorted(times, key=float):
+            sampleDefault = readSample(defaultDir, time)
+            sampleVariant = readSample(variantDir, time)
+            if sampleDefault is None or sampleVariant is None or len(sampleDefault) != len(sampleVariant):
+                print("    t = " + time + " : missing sample")
+                failed = True
+                continue
+            referenceFile = os.path.join(caseDir, "reference", times[time])
+            errorDefault = referenceError(sampleDefault, referenceFile)
+            errorVariant = referenceError(sampleVariant, referenceFile)
+            difference = max(abs(a[1]-b[1]) for a, b in zip(sampleDefault, sampleVariant))
+
+            print("    t = " + time + " : max(|h - h_reference|) = " + "%g" % errorVariant \
+                  + " (default " + "%g" % errorDefault + "), max(|h - h_default|) = " + "%g" % difference)
+
+            #- the variant must converge to the same solution, hence to the same
+            #- distance from the (digitized) reference solution
+            if difference > args.identicalTolerance \
+               or errorVariant > errorDefault + args.identicalTolerance:
+                failed = True
+
+        if failed:
+            print("[ FAILED ]")
+            nErrors += 1
+        else:
+            print("[ OK ]")
+
+    for case in runOnlyVariants:
+        print("")
+        print("Test : " + case["solver"] + " " + case["case"] + " " + case["variant"])
+
+        variantDir = os.path.join(args.workDir, case["case"]+"_"+case["variant"])
+        if not run(case["solver"], case["case"], variantDir, case["variant"]):
+            print("[ FAILED ]")
+            nErrors += 1
+        else:
+            print("[ OK ]")
+
+    print(" ")
+    print("========================================================")
+    print("                        FINISHED                        ")
+    print("========================================================")
+
+    sys.exit(1 if nErrors > 0 else 0)
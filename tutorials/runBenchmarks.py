@@ -0,0 +1,202 @@
+# -*- coding: utf-8 -*-
+## \file runBenchmarks.py for python 3
+## Script for running the tutorials on refined meshes with solver profiling
+## and comparing the timings/iterations with a stored baseline
+
+# import
+from __future__ import with_statement
+import os, re, shutil, subprocess, sys, argparse, json
+
+# import list_cases
+from tutorialsList import tutorials as testCases
+
+class benchmarkCase:
+
+    #=============================================================================
+    # ROUTINE init
+    #=============================================================================
+    def __init__(self, solver, case, workDir):
+
+        self.solver = solver
+        self.case = case
+        self.name = solver+"/"+case
+        self.testDir = solver+"-tutorials/"+case
+        self.runDir = os.path.join(workDir, self.testDir)
+
+    #=============================================================================
+    # ROUTINE prepare : copy the case, refine blockMesh and activate profiling
+    #=============================================================================
+    def prepare(self, refinement):
+
+        if os.path.exists(self.runDir):
+            shutil.rmtree(self.runDir)
+        shutil.copytree(self.testDir, self.runDir, symlinks=True)
+
+        refined = False
+        blockMeshDict = os.path.join(self.runDir, "system", "blockMeshDict")
+        if os.path.exists(blockMeshDict) and refinement > 1:
+            with open(blockMeshDict) as f:
+                content = f.read()
+            # multiply the number of cells of each hex block (except 1-cell directions)
+            def refine(match):
+                cells = [int(n) if int(n) == 1 else int(n)*refinement for n in match.group(2).split()]
+                return match.group(1)+"("+" ".join(str(n) for n in cells)+")"
+            content, nBlocks = re.subn(r"(hex\s*\([\d\s]+\)\s*)\(\s*(\d+\s+\d+\s+\d+)\s*\)", refine, content)
+            with open(blockMeshDict, 'w') as f:
+                f.write(content)
+            refined = nBlocks > 0
+
+        with open(os.path.join(self.runDir, "system", "controlDict"), 'a') as f:
+            f.write("\nsolverProfiling csv;\n")
+
+        return refined
+
+    #=============================================================================
+    # ROUTINE run
+    #=============================================================================
+    def run(self):
+
+        refDir = os.getcwd()
+        os.chdir(self.runDir)
+
+        ProcessPipe = subprocess.Popen("./run", shell=True, \
+                                       stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        stdout, stderr = ProcessPipe.communicate()
+
+        error_found = len(stderr) > 0
+        if os.path.exists("log."+self.solver):
+            for lines in open("log."+self.solver, 'r'):
+                if "FOAM exiting" in lines or "FOAM aborting" in lines:
+                    error_found = True
+                    break
+        else:
+            error_found = True
+
+        os.chdir(refDir)
+        return not error_found
+
+    #=============================================================================
+    # ROUTINE results : sum of the profiling values over all time steps
+    #=============================================================================
+    def results(self):
+
+        profilingFile = os.path.join(self.runDir, "solverProfiling.csv")
+        if not os.path.exists(profilingFile):
+            return None
+
+        header = []
+        totals = {}
+        nTimeSteps = 0
+        for line in open(profilingFile, 'r'):
+            split = line.split()
+            if len(split) == 0:
+                continue
+            if split[0] == "#Time":
+                header = split
+                continue
+            nTimeSteps += 1
+            for name, value in zip(header[2:], split[2:]):
+                totals[name] = totals.get(name, 0) + float(value)
+        totals["timeSteps"] = nTimeSteps
+        return totals
+
+#=============================================================================
+# ROUTINE compare : list of regressions with respect to the baseline
+#=============================================================================
+def compare(results, baseline, timeTolerance, iterationTolerance):
+
+    regressions = []
+    for name, value in results.items():
+        if name not in baseline:
+            continue
+        reference = baseline[name]
+        if name.endswith("(calls)"):
+            continue
+        tolerance = timeTolerance if name.endswith("(s)") else iterationTolerance
+        if value > reference*(1+tolerance) and value-reference > 1e-3:
+            regressions.append(name+" : "+"%g" % value+" (baseline "+"%g" % reference+")")
+    return regressions
+
+#===============================================================================
+# PROGRAM Main
+#===============================================================================
+
+if __name__ == '__main__':
+
+    parser = argparse.ArgumentParser(description='run the tutorials on refined meshes and compare solver profiling with a baseline')
+    parser.add_argument("-r", "--refinement", help='refinement factor of blockMesh cells (default 2)', type=int, default=2)
+    parser.add_argument("-w", "--workDir", help='directory where cases are run (default benchmarks)', default="benchmarks")
+    parser.add_argument("-b", "--baseline", help='baseline file (default benchmarkBaseline.json)', default="benchmarkBaseline.json")
+    parser.add_argument("-c", "--cases", help='run only cases containing this string', default="")
+    parser.add_argument("-t", "--timeTolerance", help='relative wall time increase reported as regression (default 0.2)', type=float, default=0.2)
+    parser.add_argument("-i", "--iterationTolerance", help='relative iteration increase reported as regression (default 0.05)', type=float, default=0.05)
+    parser.add_argument("-u", "--updateBaseline", help='store the results as new baseline', action='store_true')
+    args = parser.parse_args()
+
+    print("========================================================")
+    print("                  RUNNING BENCHMARK CASES               ")
+    print("========================================================")
+
+    baseline = {}
+    if os.path.exists(args.baseline):
+        baseline = json.load(open(args.baseline))
+    elif not args.updateBaseline:
+        print("No baseline file "+args.baseline+" found, run with -u to create it")
+
+    newBaseline = dict(baseline)
+    nRegressions = 0
+    for case in testCases:
+        test = benchmarkCase(case["solver"], case["case"], args.workDir)
+        if args.cases not in test.name:
+            continue
+
+        print("")
+        print("Benchmark : " + test.name)
+
+        refined = test.prepare(args.refinement)
+        if not refined:
+            print("    mesh not refined (no blockMeshDict with explicit cell numbers)")
+
+        if not test.run():
+            print("[ ERROR OpenFOAM ]")
+            nRegressions += 1
+            continue
+
+        results = test.results()
+        if results is None:
+            print("[ ERROR ] no solverProfiling.csv written")
+            nRegressions += 1
+            continue
+        results["refinement"] = args.refinement if refined else 1
+
+        print("    wall time = " + "%g" % results["wallTime(s)"] + " s, time steps = " + str(results["timeSteps"]) \
+              + ", linear solver iterations = " + "%g" % results["linearSolverIterations"])
+
+        if args.updateBaseline:
+            newBaseline[test.name] = results
+            print("[ BASELINE UPDATED ]")
+        elif test.name in baseline:
+            if baseline[test.name].get("refinement") != results["refinement"]:
+                print("[ SKIPPED ] baseline computed with refinement " + str(baseline[test.name].get("refinement")))
+                continue
+            regressions = compare(results, baseline[test.name], args.timeTolerance, args.iterationTolerance)
+            if len(regressions) > 0:
+                nRegressions += 1
+                print("[ REGRESSION ]")
+                for regression in regressions:
+                    print("    " + regression)
+            else:
+                print("[ OK ]")
+        else:
+            print("[ NO BASELINE ]")
+
+    if args.updateBaseline:
+        with open(args.baseline, 'w') as f:
+            json.dump(newBaseline, f, indent=2, sort_keys=True)
+
+    print(" ")
+    print("========================================================")
+    print("                        FINISHED                        ")
+    print("========================================================")
+
+    sys.exit(1 if nRegressions > 0 else 0)
@@ -18,6 +18,7 @@ tutorials = [{'solver' : "impesFoam", 'case' : "Buckley-Leverett/BrooksAndCorey"
              {'solver' : "porousScalarTransportFoam", 'case' : "1DeventFlux_CrankNicolson"}, \
              {'solver' : "porousScalarTransportFoam", 'case' : "alphaDispersion"}, \
              {'solver' : "porousScalarTransportFoam", 'case' : "1DeventFlux_multispecies"}, \
+             {'solver' : "porousScalarTransportFoam", 'case' : "1DeventFlux_multispeciesMixedBC"}, \
              {'solver' : "porousScalarTransport2DFoam", 'case' : "alphaDispersion"}, \
              {'solver' : "groundwater2DFoam", 'case' : "1Dwave_hFixed"}, \
              {'solver' : "groundwater2DFoam", 'case' : "1Dwave_UFixed"}, \